@@ -0,0 +1,232 @@
+#ifndef _ERZC_CORE_ASM_H
+#define _ERZC_CORE_ASM_H
+
+#include <erzc/core/types.h>
+
+/**
+ * \file
+ *
+ * \brief Text assembler of \ref term_input_instructions "input instructions".
+ *
+ * \details Listing is line-oriented. Each line has form:
+ *
+ * ```
+ * [name: ...] [MNEMONIC [ok [err]]] [; comment]
+ * ```
+ *
+ * where:
+ * + `name:` - defines symbol `name` referencing the next instruction in the listing. If there is
+ * no next instruction, symbol references \ref ERZC_Label_END "END". There can be several
+ * definitions on one line
+ * + `MNEMONIC` - \ref erzc/core/mnemonic.h "mnemonic" of any opcode except \ref ERZC_OP_UNDF
+ * "UNDF" and \ref ERZC_OP_GO0 "GO0" ... \ref ERZC_OP_GO5 "GO5"
+ * + `ok`, `err` - targets of out pins. Each target is one of:
+ *   + `END` - \ref ERZC_Label_END "Label_END"
+ *   + `_` - \ref ERZC_Label_UNDEFINED "Label_UNDEFINED"
+ *   + symbol name - can be defined before or after its use
+ *
+ *   Omitted targets are set to \ref ERZC_Label_UNDEFINED "Label_UNDEFINED". Only the pins the
+ *   opcode has can be given. \ref ERZC_OP_EMPTY "EMPTY" takes no targets
+ * + `; comment` - comment till the end of line (`#` can be used as well)
+ *
+ * Line `---` (optionally followed by a comment) ends the program. Everything after it belongs to
+ * the next program.
+ *
+ * Symbol names consist of `[A-Za-z0-9_.]` characters. `END` and `_` are reserved.
+ *
+ * The first instruction of the listing gets index `0`.
+ *
+ * Example:
+ *
+ * ```
+ * loop: SWLK step turn
+ * step: MOVE loop turn
+ * turn: RC090 loop
+ * ---
+ * MOVE END END
+ * ```
+ *
+ * \section asm_corpus Corpora
+ *
+ * The assembler works on a resident buffer and doesn't copy symbol names, so the intended way to
+ * process a large corpus is to map its file into memory and assemble it one program per call:
+ *
+ * ```
+ * while (len != 0) {
+ *     status = ERZC_Assemble(&assembler, src, len, &out);
+ *     if (status != ERZC_AsmStatus_OK) {
+ *         report(status, base_line + assembler.line);
+ *     } else {
+ *         ...
+ *     }
+ *     src += assembler.consumed;
+ *     len -= assembler.consumed;
+ *     base_line += assembler.lines;
+ * }
+ * ```
+ *
+ * A malformed program doesn't stop the loop: on error the rest of it is skipped.
+ *
+ * Only the pages of the current program are touched, and instruction and symbol buffers are reused
+ * between programs. Symbol table is not cleared between calls (see \ref ERZC_Assembler::generation
+ * "generation"), so each call takes time proportional to the size of its program only, no matter
+ * how large \ref ERZC_Assembler::symbols_cap "symbols_cap" is.
+ */
+
+/**
+ * \brief Status of \ref ERZC_Assemble "Assemble".
+ */
+typedef enum tagERZC_AsmStatus {
+    /**
+     * \brief Success.
+     */
+    ERZC_AsmStatus_OK = 0,
+    /**
+     * \brief Unexpected character or token.
+     */
+    ERZC_AsmStatus_SYNTAX,
+    /**
+     * \brief Unknown or forbidden mnemonic.
+     */
+    ERZC_AsmStatus_MNEMONIC,
+    /**
+     * \brief More targets than the opcode has out pins.
+     */
+    ERZC_AsmStatus_PINS,
+    /**
+     * \brief Symbol is defined more than once.
+     */
+    ERZC_AsmStatus_DUPLICATE_SYMBOL,
+    /**
+     * \brief Symbol is referenced but never defined.
+     */
+    ERZC_AsmStatus_UNDEFINED_SYMBOL,
+    /**
+     * \brief Not enough space for instructions.
+     */
+    ERZC_AsmStatus_NO_DATA_SPACE,
+    /**
+     * \brief Not enough space for symbols.
+     */
+    ERZC_AsmStatus_NO_SYMBOL_SPACE,
+} ERZC_AsmStatus;
+
+/**
+ * \brief Symbol table entry.
+ *
+ * \details Entries are owned by the caller and filled by \ref ERZC_Assemble "Assemble". Names are
+ * not copied - they point into the source listing.
+ */
+typedef struct __tagERZC_AsmSymbol {
+    /**
+     * \brief Generation of \ref ERZC_Assembler "assembler" the entry was filled in.
+     *
+     * \details Entry is used iff it equals to \ref ERZC_Assembler::generation
+     * "Assembler::generation", otherwise the rest of the fields are meaningless.
+     */
+    size_t generation;
+    /**
+     * \brief Name.
+     */
+    const char *name;
+    /**
+     * \brief Length of \ref ERZC_AsmSymbol::name "name".
+     */
+    size_t len;
+    /**
+     * \brief Referenced label or \ref ERZC_Label_UNDEFINED "Label_UNDEFINED" if symbol hasn't
+     * been defined (yet).
+     */
+    ERZC_Label label;
+    /**
+     * \brief Line (starting from `1`) of the first occurrence.
+     */
+    size_t line;
+} ERZC_AsmSymbol;
+
+/**
+ * \brief Assembler.
+ *
+ * \details All buffers are provided by the caller; \ref ERZC_Assemble "Assemble" doesn't allocate.
+ */
+typedef struct __tagERZC_Assembler {
+    /**
+     * \brief Buffer for instructions.
+     */
+    ERZC_Instruction *data;
+    /**
+     * \brief Capacity of \ref ERZC_Assembler::data "data".
+     */
+    size_t cap;
+    /**
+     * \brief Buffer for symbol table (open addressing hash table).
+     */
+    ERZC_AsmSymbol *symbols;
+    /**
+     * \brief Capacity of \ref ERZC_Assembler::symbols "symbols".
+     *
+     * \warning Must be a power of two, less or equal than \ref ERZC_Label_QUASI_MIN
+     * "Label_QUASI_MIN".
+     */
+    size_t symbols_cap;
+    /**
+     * \brief Generation of \ref ERZC_Assembler::symbols "symbols".
+     *
+     * \details Incremented by every \ref ERZC_Assemble "Assemble" call, which makes entries of the
+     * previous calls unused without clearing the table.
+     *
+     * \warning Before the first call both this field and \ref ERZC_AsmSymbol::generation
+     * "generation" of all symbols must be set to `0` (e.g. by zero-initialization). Keep them when
+     * switching to another listing.
+     */
+    size_t generation;
+    /**
+     * \brief Line (starting from `1` at `src` passed to \ref ERZC_Assemble "Assemble") where the
+     * error occurred.
+     *
+     * \details Set by \ref ERZC_Assemble "Assemble". `0` on success.
+     */
+    size_t line;
+    /**
+     * \brief Number of characters of the listing belonging to the assembled program (including
+     * its separator, if any).
+     *
+     * \details Set by \ref ERZC_Assemble "Assemble" both on success and on error. On error the
+     * rest of the failing program is skipped (up to and including the next separator), so the
+     * caller can continue with the next program.
+     */
+    size_t consumed;
+    /**
+     * \brief Number of lines (`\n` characters) in the \ref ERZC_Assembler::consumed "consumed"
+     * part of the listing.
+     *
+     * \details Set together with \ref ERZC_Assembler::consumed "consumed". Allows to report lines
+     * relative to the whole corpus.
+     */
+    size_t lines;
+} ERZC_Assembler;
+
+/**
+ * \brief Assembles the listing into \ref ERZC_InInstructions "input instructions".
+ *
+ * \details The listing is parsed in one pass up to the first program separator (or its end).
+ * References to symbols that are defined later are patched after the pass by walking over the
+ * produced instructions only.
+ *
+ * \warning Names of \ref ERZC_Assembler::symbols "symbols" point into `src`, so they are valid only
+ * while `src` is.
+ *
+ * \param[in,out] assembler assembler. **MUST NOT** be `NULL`
+ * \param[in]     src       listing (not necessarily null-terminated). Can be `NULL` iff `len` is
+ * `0`
+ * \param[in]     len       length of `src`
+ * \param[out]    out       produced instructions, pointing to \ref ERZC_Assembler::data "data".
+ * **MUST NOT** be `NULL`. Valid only on success
+ *
+ * \return \ref ERZC_AsmStatus_OK "AsmStatus_OK" on success, error status otherwise
+ */
+ERZC_AsmStatus ERZC_Assemble(
+    ERZC_Assembler *assembler, const char *src, size_t len, ERZC_InInstructions *out
+);
+
+#endif /* _ERZC_CORE_ASM_H */
@@ -0,0 +1,41 @@
+#ifndef _ERZC_CORE_DISASM_H
+#define _ERZC_CORE_DISASM_H
+
+#include <erzc/core/types.h>
+
+/**
+ * \file
+ *
+ * \brief Text disassembler of \ref ERZC_Program "program".
+ *
+ * \details Listing consists of:
+ * + one line per set \ref term_named_labels "named label" (i.e. not equal to \ref ERZC_Label_END
+ * "Label_END") of form `GOn: x y`
+ * + \ref ERZC_HEIGHT "HEIGHT" lines of the grid, each of them consists of \ref ERZC_WIDTH "WIDTH"
+ * \ref erzc/core/mnemonic.h "mnemonics" separated by spaces and padded to the same width. \ref
+ * ERZC_OP_UNDF "UNDF" instructions are printed as `.`, unknown opcodes - as `?`
+ * + one line per cell whose \ref ERZC_Instruction::ok "ok" or \ref ERZC_Instruction::err "err"
+ * label differs from the neighbour cell in the direction of the pin, of form
+ * `x y: [ok=T] [err=T]`, where `T` is `END`, `_` (for \ref ERZC_Label_UNDEFINED "Label_UNDEFINED")
+ * or `x,y`. Only pins with direction are printed: `ok` label of \ref ERZC_OP_EMPTY "EMPTY" and \ref
+ * ERZC_OP_GO0 "GOn" has no effect (they end execution and go to the \ref term_named_labels "named
+ * label" respectively, see \ref erzc/core/equivalence.h "equivalence.h"), so it is not printed
+ *
+ * Each line ends with `\n`.
+ */
+
+/**
+ * \brief Disassembles the \ref ERZC_Program "program".
+ *
+ * \details Behaves like `snprintf`: writes at most `cap - 1` characters followed by `\0` (if `cap`
+ * isn't `0`) and returns the length of the whole listing.
+ *
+ * \param[in]  program program. **MUST NOT** be `NULL`
+ * \param[out] buf     buffer. Can be `NULL` iff `cap` is `0`
+ * \param[in]  cap     capacity of `buf`
+ *
+ * \return length of the listing (without `\0`)
+ */
+size_t ERZC_Disassemble(const ERZC_Program *program, char *buf, size_t cap);
+
+#endif /* _ERZC_CORE_DISASM_H */
@@ -0,0 +1,134 @@
+#ifndef _ERZC_CORE_EQUIVALENCE_H
+#define _ERZC_CORE_EQUIVALENCE_H
+
+#include <erzc/core/types.h>
+
+/**
+ * \file
+ *
+ * \brief Equivalence check between \ref term_input_instructions "input instructions" and \ref
+ * ERZC_Program "program".
+ *
+ * \details Input instructions and program are equivalent if, for every sequence of ok/err outcomes,
+ * both of them execute the same sequence of \ref term_instruction_real "real" instructions and
+ * both either end or loop forever without executing any real instruction. Input instructions are
+ * executed starting from index `0` (or end immediately if there are none), program - from cell
+ * `(0, 0)`.
+ *
+ * \ref ERZC_Label_UNDEFINED "Label_UNDEFINED" in input instructions means "don't care": anything
+ * the program does from that point on is accepted.
+ *
+ * Program control flow follows \ref ERZC_Instruction::ok "ok" and \ref ERZC_Instruction::err
+ * "err" labels, which must agree with the pin directions of the opcode: each of them is either \ref
+ * ERZC_Label_END "Label_END" or the neighbour cell in the direction of the pin. \ref ERZC_OP_GO0
+ * "GOn" leads to the corresponding \ref term_named_labels "named label" and \ref ERZC_OP_EMPTY
+ * "EMPTY" ends execution; their `ok` labels are ignored.
+ */
+
+/**
+ * \brief Result of \ref ERZC_CheckEquivalent "CheckEquivalent".
+ */
+typedef enum tagERZC_Equivalence {
+    /**
+     * \brief Proven to be equivalent.
+     */
+    ERZC_Equivalence_EQUIVALENT = 0,
+    /**
+     * \brief Proven to be different.
+     *
+     * \note Program that reaches \ref ERZC_OP_UNDF "UNDF" instruction, unknown opcode, label
+     * outside of the grid or label that disagrees with the pin direction is considered different
+     * as well.
+     */
+    ERZC_Equivalence_DIFFERENT,
+    /**
+     * \brief No difference found, but the walk wasn't finished because \ref
+     * ERZC_EquivalenceScratch::pairs "pairs" table is full.
+     */
+    ERZC_Equivalence_UNKNOWN,
+    /**
+     * \brief Input instructions don't meet \ref ERZC_InInstructions "requirements": reachable
+     * label is out of range or reachable instruction is \ref ERZC_OP_UNDF "UNDF" or \ref
+     * ERZC_OP_GO0 "GOn".
+     */
+    ERZC_Equivalence_INVALID_INPUT,
+} ERZC_Equivalence;
+
+/**
+ * \brief Pair of input instruction index and program cell index visited by \ref
+ * ERZC_CheckEquivalent "CheckEquivalent".
+ */
+typedef struct __tagERZC_EquivalencePair {
+    /**
+     * \brief Index of input instruction. \ref ERZC_Label_END "Label_END" if entry is unused.
+     */
+    ERZC_Label in;
+    /**
+     * \brief Index of program cell (`y * WIDTH + x`).
+     */
+    ERZC_Label cell;
+} ERZC_EquivalencePair;
+
+/**
+ * \brief Scratch memory for \ref ERZC_CheckEquivalent "CheckEquivalent".
+ *
+ * \details All buffers are provided by the caller and can be reused between calls; their contents
+ * don't have to be initialized.
+ */
+typedef struct __tagERZC_EquivalenceScratch {
+    /**
+     * \brief Resolved targets of input instructions. At least `in->len` entries.
+     */
+    size_t *in;
+    /**
+     * \brief Resolved targets of program cells. At least \ref ERZC_SIZE "SIZE" entries.
+     */
+    size_t *program;
+    /**
+     * \brief Visited pairs (open addressing hash table). \ref ERZC_EquivalenceScratch::pairs_cap
+     * "pairs_cap" entries.
+     */
+    ERZC_EquivalencePair *pairs;
+    /**
+     * \brief Pairs waiting for their successors to be checked. \ref
+     * ERZC_EquivalenceScratch::pairs_cap "pairs_cap" entries.
+     */
+    ERZC_EquivalencePair *stack;
+    /**
+     * \brief Capacity of \ref ERZC_EquivalenceScratch::pairs "pairs" and \ref
+     * ERZC_EquivalenceScratch::stack "stack".
+     *
+     * \warning Must be a power of two. At most `pairs_cap - 1` pairs are visited, so the result
+     * is guaranteed not to be \ref ERZC_Equivalence_UNKNOWN "Equivalence_UNKNOWN" if `pairs_cap`
+     * is at least the number of reachable pairs of real input instruction and real program cell
+     * plus one. That number never exceeds `R_in * R_program`, where `R_in` is the number of real
+     * input instructions and `R_program` is the number of real program cells, so the hard bound is
+     * `in->len * SIZE + 1` (rounded up to a power of two).
+     *
+     * \note Usually every real program cell is reached with one input instruction only, so twice
+     * the number of real program cells (rounded up to a power of two) is enough in practice.
+     */
+    size_t pairs_cap;
+} ERZC_EquivalenceScratch;
+
+/**
+ * \brief Checks if the \ref ERZC_Program "program" is equivalent to the \ref ERZC_InInstructions
+ * "input instructions".
+ *
+ * \details Walks the product of both graphs. Every reached pair of real input instruction and real
+ * program cell is checked once. Chains of not \ref term_instruction_real "real" instructions are
+ * resolved once per instruction and memoized, so the check takes `O(in->len + SIZE + pairs_cap)`
+ * time (the last term is clearing the \ref ERZC_EquivalenceScratch::pairs "pairs" table). Doesn't
+ * allocate.
+ *
+ * \param[in]     in      input instructions. **MUST NOT** be `NULL`
+ * \param[in]     program program. **MUST NOT** be `NULL`
+ * \param[in,out] scratch scratch memory. **MUST NOT** be `NULL`
+ *
+ * \return check result
+ */
+ERZC_Equivalence ERZC_CheckEquivalent(
+    const ERZC_InInstructions *in, const ERZC_Program *program, ERZC_EquivalenceScratch *scratch
+);
+
+#endif /* _ERZC_CORE_EQUIVALENCE_H */
@@ -0,0 +1,37 @@
+#ifndef _ERZC_CORE_MNEMONIC_H
+#define _ERZC_CORE_MNEMONIC_H
+
+#include <erzc/core/types.h>
+
+/**
+ * \file
+ *
+ * \brief \ref ERZC_OP "Opcode" mnemonics.
+ *
+ * \details Mnemonic of an opcode is its name without `ERZC_OP_` prefix (e.g. `MOVE` for \ref
+ * ERZC_OP_MOVE "OP_MOVE").
+ */
+
+/**
+ * \brief Returns mnemonic of the \ref ERZC_OP "opcode".
+ *
+ * \param op opcode
+ *
+ * \return null-terminated mnemonic or `NULL` if `op` is not a known opcode
+ */
+const char *ERZC_OP_GetMnemonic(ERZC_OP op);
+
+/**
+ * \brief Finds \ref ERZC_OP "opcode" by its mnemonic.
+ *
+ * \details Matching is case-sensitive.
+ *
+ * \param[in]  str mnemonic (not necessarily null-terminated). **MUST NOT** be `NULL`
+ * \param[in]  len length of `str`
+ * \param[out] op  found opcode. **MUST NOT** be `NULL`. Not changed if mnemonic is unknown
+ *
+ * \return non-zero if mnemonic is known, `0` otherwise
+ */
+int ERZC_OP_FromMnemonic(const char *str, size_t len, ERZC_OP *op);
+
+#endif /* _ERZC_CORE_MNEMONIC_H */
@@ -34,4 +34,17 @@ void ERZC_Program_Init(ERZC_Program *program);
  */
 #define ERZC_Program_Reset(program) ERZC_Program_Init(program)
 
+/**
+ * \brief Returns \ref ERZC_Label "label" of the program cell next to the given one.
+ *
+ * \param label     label of the cell. **MUST** be a not quasi label inside the program
+ * \param direction direction (value returned by \ref ERZC_OP_GetOk "OP_GetOk" or \ref
+ * ERZC_OP_GetErr "OP_GetErr")
+ *
+ * \return label of the neighbour or \ref ERZC_Label_UNDEFINED "Label_UNDEFINED" if there is no
+ * neighbour in that direction (edge of the program) or `direction` isn't \ref ERZC_Direction
+ * "Direction"
+ */
+ERZC_Label ERZC_Program_GetNeighbour(ERZC_Label label, uint32_t direction);
+
 #endif /* _ERZC_CORE_PROGRAM_H */
@@ -221,7 +221,7 @@ typedef uint32_t ERZC_Label;
  * \warning Can be used only at \ref term_output_instructions "output instructions" not-quasi
  * labels.
  */
-#define ERZC_Label_GetY(label) (((ERZC_Label)(label) & (0xFFFF << 16)) >> 16)
+#define ERZC_Label_GetY(label) (((ERZC_Label)(label) & (0xFFFFu << 16)) >> 16)
 
 #define __ERZC_OP_OK_RSHIFT 0
 #define __ERZC_OP_OK_LABEL_RSHIFT 8
@@ -512,7 +512,7 @@ typedef enum __tagERZC_OP {
      * ERZC_Instruction::ok "ok" and \ref ERZC_Instruction::err "err".
      */
     ERZC_OP_SHND =
-        __ERZC_OP_BUILD(__ERZC_OP_NR_REAL_MIN + 10u, ERZC_Direction_RIGHT, ERZC_Direction_DOWN),
+        __ERZC_OP_BUILD(__ERZC_OP_NR_REAL_MIN + 16u, ERZC_Direction_RIGHT, ERZC_Direction_DOWN),
     /**
      * \brief Scans the cell for `notHandmade` property.
      *
@@ -520,7 +520,7 @@ typedef enum __tagERZC_OP {
      * ERZC_Instruction::ok "ok" and \ref ERZC_Instruction::err "err".
      */
     ERZC_OP_NHND =
-        __ERZC_OP_BUILD(__ERZC_OP_NR_REAL_MIN + 11u, ERZC_Direction_RIGHT, ERZC_Direction_DOWN),
+        __ERZC_OP_BUILD(__ERZC_OP_NR_REAL_MIN + 17u, ERZC_Direction_RIGHT, ERZC_Direction_DOWN),
 } ERZC_OP;
 
 /**
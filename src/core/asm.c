@@ -0,0 +1,305 @@
+#include <erzc/core/asm.h>
+
+#include <erzc/common/assert.h>
+#include <erzc/core/mnemonic.h>
+
+#include <stddef.h> /* NULL, size_t */
+#include <string.h> /* memcmp */
+
+#define __ERZC_ASM_IS_SPACE(c) ((c) == ' ' || (c) == '\t' || (c) == '\r')
+#define __ERZC_ASM_IS_COMMENT(c) ((c) == ';' || (c) == '#')
+#define __ERZC_ASM_IS_NAME(c)                                                                      \
+    (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') || ((c) >= '0' && (c) <= '9') ||    \
+     (c) == '_' || (c) == '.')
+
+#define __ERZC_ASM_IS_END(str, len) ((len) == 3u && memcmp((str), "END", 3u) == 0)
+#define __ERZC_ASM_IS_UNDEFINED(str, len) ((len) == 1u && (str)[0] == '_')
+
+/**
+ * \brief Returns number of out pins the opcode takes targets for.
+ */
+static unsigned ERZC_Asm_PinNumber(ERZC_OP op) {
+    if (ERZC_OP_GetErr(op) != ERZC_PIN_NONE) return 2u;
+    if (op == ERZC_OP_EMPTY) return 0u;
+    return 1u;
+}
+
+/**
+ * \brief FNV-1a.
+ */
+static uint32_t ERZC_Asm_Hash(const char *str, size_t len) {
+    uint32_t hash = 2166136261u;
+
+    while (len--) {
+        hash ^= (unsigned char)*str++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/**
+ * \brief Finds symbol by name or inserts a new undefined one.
+ *
+ * \return index of symbol in the table or `symbols_cap` if the table is full
+ */
+static size_t
+ERZC_Asm_Symbol(ERZC_Assembler *assembler, const char *name, size_t len, size_t line) {
+    size_t mask = assembler->symbols_cap - 1u;
+    size_t i = (size_t)ERZC_Asm_Hash(name, len) & mask;
+    size_t probe;
+    ERZC_AsmSymbol *symbol;
+
+    for (probe = 0; probe < assembler->symbols_cap; ++probe, i = (i + 1u) & mask) {
+        symbol = &assembler->symbols[i];
+
+        if (symbol->generation != assembler->generation) {
+            symbol->generation = assembler->generation;
+            symbol->name = name;
+            symbol->len = len;
+            symbol->label = ERZC_Label_UNDEFINED;
+            symbol->line = line;
+            return i;
+        }
+
+        if (symbol->len == len && memcmp(symbol->name, name, len) == 0) return i;
+    }
+
+    return assembler->symbols_cap;
+}
+
+/**
+ * \brief Checks if the text starting at `p` is a program separator line (`---' optionally followed
+ * by a comment).
+ *
+ * \return pointer to the end of the separator line (`\n' or `end') or `NULL' if it isn't one
+ */
+static const char *ERZC_Asm_Separator(const char *p, const char *end) {
+    if (end - p < 3 || p[0] != '-' || p[1] != '-' || p[2] != '-') return NULL;
+
+    p += 3;
+    while (p < end && __ERZC_ASM_IS_SPACE(*p)) ++p;
+    if (p < end && *p != '\n' && !__ERZC_ASM_IS_COMMENT(*p)) return NULL;
+    while (p < end && *p != '\n') ++p;
+
+    return p;
+}
+
+/**
+ * \brief Replaces symbol table indexes in the label with the labels they reference.
+ */
+static ERZC_AsmStatus
+ERZC_Asm_Resolve(ERZC_Assembler *assembler, ERZC_Label *label, size_t instruction_number) {
+    const ERZC_AsmSymbol *symbol;
+
+    if (ERZC_Label_IsQuasi(*label)) return ERZC_AsmStatus_OK;
+
+    symbol = &assembler->symbols[*label];
+    if (symbol->label == ERZC_Label_UNDEFINED) {
+        assembler->line = symbol->line;
+        return ERZC_AsmStatus_UNDEFINED_SYMBOL;
+    }
+
+    /* NOTE: symbol defined after the last instruction */
+    *label = (size_t)symbol->label == instruction_number ? ERZC_Label_END : symbol->label;
+
+    return ERZC_AsmStatus_OK;
+}
+
+ERZC_AsmStatus ERZC_Assemble(
+    ERZC_Assembler *assembler, const char *src, size_t len, ERZC_InInstructions *out
+) {
+    const char *p = src;
+    const char *end = src + len;
+    const char *token;
+    const char *separator_end;
+    size_t token_len;
+    size_t cap;
+    size_t n = 0;
+    size_t i;
+    size_t line = 1;
+    unsigned targets;
+    int tokens;
+    int separator = 0;
+    ERZC_Label label;
+    ERZC_OP op;
+    ERZC_Instruction *instruction;
+    ERZC_AsmStatus status;
+
+    ERZC_ASSERT_MSG(assembler != NULL, "param `assembler' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(src != NULL || len == 0, "param `src' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(out != NULL, "param `out' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(assembler->data != NULL || assembler->cap == 0, "`data' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(assembler->symbols != NULL, "`symbols' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(
+        assembler->symbols_cap != 0 &&
+            (assembler->symbols_cap & (assembler->symbols_cap - 1u)) == 0,
+        "`symbols_cap' MUST be a power of two"
+    );
+    ERZC_ASSERT_MSG(
+        assembler->symbols_cap <= ERZC_Label_QUASI_MIN,
+        "`symbols_cap' MUST be less or equal than Label_QUASI_MIN"
+    );
+
+    /* NOTE: one index is reserved for symbols defined after the last instruction */
+    cap = assembler->cap < ERZC_Label_QUASI_MIN ? assembler->cap : ERZC_Label_QUASI_MIN - 1u;
+
+    /* NOTE: entries of previous calls are free, so the table is cleared only on wrap-around */
+    if (++assembler->generation == 0) {
+        for (i = 0; i < assembler->symbols_cap; ++i) {
+            assembler->symbols[i].generation = 0;
+        }
+        assembler->generation = 1;
+    }
+
+    while (p < end && !separator) {
+        instruction = NULL;
+        targets = 0;
+        tokens = 0;
+
+        for (;;) {
+            while (p < end && __ERZC_ASM_IS_SPACE(*p)) ++p;
+
+            if (p == end || *p == '\n') break;
+            if (__ERZC_ASM_IS_COMMENT(*p)) {
+                while (p < end && *p != '\n') ++p;
+                break;
+            }
+
+            if (*p == '-') {
+                /* program separator: `---' on its own line */
+                separator_end = ERZC_Asm_Separator(p, end);
+                if (tokens != 0 || separator_end == NULL) goto syntax_error;
+
+                p = separator_end;
+                separator = 1;
+                break;
+            }
+
+            ++tokens;
+            token = p;
+            while (p < end && __ERZC_ASM_IS_NAME(*p)) ++p;
+            token_len = (size_t)(p - token);
+
+            if (token_len == 0) goto syntax_error;
+
+            if (instruction == NULL && p < end && *p == ':') {
+                /* symbol definition */
+                ++p;
+
+                if (__ERZC_ASM_IS_END(token, token_len) ||
+                    __ERZC_ASM_IS_UNDEFINED(token, token_len))
+                    goto syntax_error;
+
+                i = ERZC_Asm_Symbol(assembler, token, token_len, line);
+                if (i == assembler->symbols_cap) {
+                    status = ERZC_AsmStatus_NO_SYMBOL_SPACE;
+                    goto error;
+                }
+                if (assembler->symbols[i].label != ERZC_Label_UNDEFINED) {
+                    status = ERZC_AsmStatus_DUPLICATE_SYMBOL;
+                    goto error;
+                }
+
+                assembler->symbols[i].label = (ERZC_Label)n;
+                continue;
+            }
+
+            if (instruction == NULL) {
+                /* mnemonic */
+                if (!ERZC_OP_FromMnemonic(token, token_len, &op) || op == ERZC_OP_UNDF ||
+                    (ERZC_OP_GetOk(op) == ERZC_PIN_SOME && op != ERZC_OP_EMPTY)) {
+                    status = ERZC_AsmStatus_MNEMONIC;
+                    goto error;
+                }
+                if (n == cap) {
+                    status = ERZC_AsmStatus_NO_DATA_SPACE;
+                    goto error;
+                }
+
+                instruction = &assembler->data[n++];
+                instruction->op = op;
+                instruction->ok = op == ERZC_OP_EMPTY ? ERZC_Label_END : ERZC_Label_UNDEFINED;
+                instruction->err = ERZC_Label_UNDEFINED;
+                continue;
+            }
+
+            /* target */
+            if (targets == ERZC_Asm_PinNumber(instruction->op)) {
+                status = ERZC_AsmStatus_PINS;
+                goto error;
+            }
+
+            if (__ERZC_ASM_IS_END(token, token_len)) {
+                label = ERZC_Label_END;
+            } else if (__ERZC_ASM_IS_UNDEFINED(token, token_len)) {
+                label = ERZC_Label_UNDEFINED;
+            } else {
+                /* NOTE: symbol table index, resolved after the pass */
+                i = ERZC_Asm_Symbol(assembler, token, token_len, line);
+                if (i == assembler->symbols_cap) {
+                    status = ERZC_AsmStatus_NO_SYMBOL_SPACE;
+                    goto error;
+                }
+                label = (ERZC_Label)i;
+            }
+
+            if (targets++ == 0) {
+                instruction->ok = label;
+            } else {
+                instruction->err = label;
+            }
+        }
+
+        if (p < end) {
+            ++p; /* '\n' */
+            ++line;
+        }
+    }
+
+    assembler->consumed = (size_t)(p - src);
+    assembler->lines = line - 1u;
+
+    for (i = 0; i < n; ++i) {
+        status = ERZC_Asm_Resolve(assembler, &assembler->data[i].ok, n);
+        if (status != ERZC_AsmStatus_OK) return status;
+
+        status = ERZC_Asm_Resolve(assembler, &assembler->data[i].err, n);
+        if (status != ERZC_AsmStatus_OK) return status;
+    }
+
+    out->len = n;
+    out->data = assembler->data;
+    assembler->line = 0;
+
+    return ERZC_AsmStatus_OK;
+
+syntax_error:
+    status = ERZC_AsmStatus_SYNTAX;
+error:
+    assembler->line = line;
+
+    /* NOTE: skip the rest of the failing program, so the caller can continue with the next one */
+    for (;;) {
+        while (p < end && *p != '\n') ++p;
+        if (p == end) break;
+        ++p;
+        ++line;
+
+        while (p < end && __ERZC_ASM_IS_SPACE(*p)) ++p;
+        separator_end = ERZC_Asm_Separator(p, end);
+        if (separator_end != NULL) {
+            p = separator_end;
+            if (p < end) {
+                ++p;
+                ++line;
+            }
+            break;
+        }
+    }
+
+    assembler->consumed = (size_t)(p - src);
+    assembler->lines = line - 1u;
+
+    return status;
+}
@@ -0,0 +1,135 @@
+#include <erzc/core/disasm.h>
+
+#include <erzc/common/assert.h>
+#include <erzc/core/mnemonic.h>
+#include <erzc/core/program.h>
+
+#include <stddef.h> /* NULL, size_t */
+
+/**
+ * \brief Width of the grid column. Equals to the length of the longest mnemonic.
+ */
+#define __ERZC_DISASM_COLUMN 5u
+
+/**
+ * \brief Output buffer. Counts all characters but writes only those that fit.
+ */
+typedef struct __tagERZC_DisasmBuf {
+    char *buf;
+    size_t cap;
+    size_t len;
+} ERZC_DisasmBuf;
+
+static void ERZC_Disasm_PutChar(ERZC_DisasmBuf *out, char c) {
+    if (out->len + 1u < out->cap) out->buf[out->len] = c;
+    ++out->len;
+}
+
+static void ERZC_Disasm_PutStr(ERZC_DisasmBuf *out, const char *str) {
+    while (*str != '\0') ERZC_Disasm_PutChar(out, *str++);
+}
+
+static void ERZC_Disasm_PutUInt(ERZC_DisasmBuf *out, uint32_t value) {
+    char digits[10];
+    size_t n = 0;
+
+    do {
+        digits[n++] = (char)('0' + value % 10u);
+        value /= 10u;
+    } while (value != 0);
+
+    while (n != 0) ERZC_Disasm_PutChar(out, digits[--n]);
+}
+
+static void ERZC_Disasm_PutLabel(ERZC_DisasmBuf *out, ERZC_Label label) {
+    if (label == ERZC_Label_END) {
+        ERZC_Disasm_PutStr(out, "END");
+    } else if (label == ERZC_Label_UNDEFINED) {
+        ERZC_Disasm_PutChar(out, '_');
+    } else {
+        ERZC_Disasm_PutUInt(out, ERZC_Label_GetX(label));
+        ERZC_Disasm_PutChar(out, ',');
+        ERZC_Disasm_PutUInt(out, ERZC_Label_GetY(label));
+    }
+}
+
+/**
+ * \brief Checks if the pin has direction and its label differs from the neighbour in it.
+ */
+static int ERZC_Disasm_IsNonDefault(ERZC_Label self, uint32_t pin, ERZC_Label label) {
+    if (pin == ERZC_PIN_NONE || pin == ERZC_PIN_SOME) return 0;
+    return label != ERZC_Program_GetNeighbour(self, pin);
+}
+
+size_t ERZC_Disassemble(const ERZC_Program *program, char *buf, size_t cap) {
+    ERZC_DisasmBuf out;
+    const char *mnemonic;
+    size_t x, y, i;
+    ERZC_Label label;
+    ERZC_OP op;
+    const ERZC_Instruction *instruction;
+    int ok, err;
+
+    ERZC_ASSERT_MSG(program != NULL, "param `program' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(buf != NULL || cap == 0, "param `buf' MUST NOT be NULL");
+
+    out.buf = buf;
+    out.cap = cap;
+    out.len = 0;
+
+    for (i = 0; i < ERZC_NAMED_LABEL_NUMBER; ++i) {
+        if (program->labels[i] == ERZC_Label_END) continue;
+
+        ERZC_Disasm_PutStr(&out, "GO");
+        ERZC_Disasm_PutChar(&out, (char)('0' + i));
+        ERZC_Disasm_PutStr(&out, ": ");
+        ERZC_Disasm_PutUInt(&out, ERZC_Label_GetX(program->labels[i]));
+        ERZC_Disasm_PutChar(&out, ' ');
+        ERZC_Disasm_PutUInt(&out, ERZC_Label_GetY(program->labels[i]));
+        ERZC_Disasm_PutChar(&out, '\n');
+    }
+
+    for (y = 0; y < ERZC_HEIGHT; ++y) {
+        for (x = 0; x < ERZC_WIDTH; ++x) {
+            op = program->data[y * ERZC_WIDTH + x].op;
+            mnemonic = op == ERZC_OP_UNDF ? "." : ERZC_OP_GetMnemonic(op);
+            if (mnemonic == NULL) mnemonic = "?";
+
+            if (x != 0) ERZC_Disasm_PutChar(&out, ' ');
+            for (i = 0; mnemonic[i] != '\0'; ++i) ERZC_Disasm_PutChar(&out, mnemonic[i]);
+            if (x + 1u == ERZC_WIDTH) continue;
+            for (; i < __ERZC_DISASM_COLUMN; ++i) ERZC_Disasm_PutChar(&out, ' ');
+        }
+        ERZC_Disasm_PutChar(&out, '\n');
+    }
+
+    for (y = 0; y < ERZC_HEIGHT; ++y) {
+        for (x = 0; x < ERZC_WIDTH; ++x) {
+            label = (ERZC_Label)(x | (y << 16));
+            instruction = &program->data[y * ERZC_WIDTH + x];
+            op = instruction->op;
+
+            ok = ERZC_Disasm_IsNonDefault(label, ERZC_OP_GetOk(op), instruction->ok);
+            err = ERZC_Disasm_IsNonDefault(label, ERZC_OP_GetErr(op), instruction->err);
+            if (!ok && !err) continue;
+
+            ERZC_Disasm_PutUInt(&out, (uint32_t)x);
+            ERZC_Disasm_PutChar(&out, ' ');
+            ERZC_Disasm_PutUInt(&out, (uint32_t)y);
+            ERZC_Disasm_PutChar(&out, ':');
+            if (ok) {
+                ERZC_Disasm_PutStr(&out, " ok=");
+                ERZC_Disasm_PutLabel(&out, instruction->ok);
+            }
+            if (err) {
+                ERZC_Disasm_PutStr(&out, " err=");
+                ERZC_Disasm_PutLabel(&out, instruction->err);
+            }
+            ERZC_Disasm_PutChar(&out, '\n');
+        }
+    }
+
+    if (cap != 0) out.buf[out.len < cap ? out.len : cap - 1u] = '\0';
+
+    return out.len;
+}
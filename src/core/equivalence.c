@@ -0,0 +1,291 @@
+#include <erzc/core/equivalence.h>
+
+#include <erzc/common/assert.h>
+#include <erzc/core/program.h>
+
+#include <stddef.h> /* NULL, size_t */
+
+/* NOTE: resolved targets. Real ones are indexes of input instructions or program cells */
+#define __ERZC_EQ_END ((size_t)-1)
+#define __ERZC_EQ_UNDEFINED ((size_t)-2)
+#define __ERZC_EQ_DIVERGE ((size_t)-3)
+#define __ERZC_EQ_INVALID ((size_t)-4)
+/* NOTE: memo states */
+#define __ERZC_EQ_UNKNOWN ((size_t)-5)
+#define __ERZC_EQ_PENDING ((size_t)-6)
+
+#define __ERZC_EQ_IS_REAL(op) (ERZC_OP_GetNr(op) >= __ERZC_OP_NR_REAL_MIN)
+#define __ERZC_EQ_IS_GO(op)                                                                        \
+    (ERZC_OP_GetOk(op) == ERZC_PIN_SOME && (op) != ERZC_OP_EMPTY &&                                \
+     ERZC_OP_GetOkLabel(op) < ERZC_NAMED_LABEL_NUMBER)
+#define __ERZC_EQ_IS_PC(op)                                                                        \
+    ((op) == ERZC_OP_PCW || (op) == ERZC_OP_PCA || (op) == ERZC_OP_PCS || (op) == ERZC_OP_PCD)
+
+/**
+ * \brief Follows not real input instructions starting from the label.
+ *
+ * \details Results for all instructions on the chain are memoized, so every instruction is walked
+ * at most once per check.
+ */
+static size_t ERZC_Eq_ResolveIn(const ERZC_InInstructions *in, size_t *memo, ERZC_Label label) {
+    size_t result;
+    size_t i;
+    ERZC_OP op;
+    ERZC_Label start = label;
+
+    if (label == ERZC_Label_END) return __ERZC_EQ_END;
+    if (label == ERZC_Label_UNDEFINED) return __ERZC_EQ_UNDEFINED;
+    if (label >= in->len) return __ERZC_EQ_INVALID;
+
+    for (i = label;;) {
+        if (memo[i] != __ERZC_EQ_UNKNOWN) {
+            result = memo[i] == __ERZC_EQ_PENDING ? __ERZC_EQ_DIVERGE : memo[i];
+            break;
+        }
+
+        op = in->data[i].op;
+        if (__ERZC_EQ_IS_REAL(op)) {
+            result = i;
+            break;
+        }
+        if (op == ERZC_OP_EMPTY) {
+            result = __ERZC_EQ_END;
+            break;
+        }
+        if (!__ERZC_EQ_IS_PC(op)) {
+            result = __ERZC_EQ_INVALID;
+            break;
+        }
+
+        memo[i] = __ERZC_EQ_PENDING;
+
+        label = in->data[i].ok;
+        if (label == ERZC_Label_END) {
+            result = __ERZC_EQ_END;
+            break;
+        }
+        if (label == ERZC_Label_UNDEFINED) {
+            result = __ERZC_EQ_UNDEFINED;
+            break;
+        }
+        if (label >= in->len) {
+            result = __ERZC_EQ_INVALID;
+            break;
+        }
+        i = label;
+    }
+
+    for (i = start; i < in->len && memo[i] == __ERZC_EQ_PENDING;) {
+        memo[i] = result;
+        i = in->data[i].ok;
+    }
+
+    return result;
+}
+
+/**
+ * \brief Converts program label to cell index.
+ *
+ * \return cell index, \ref __ERZC_EQ_END or \ref __ERZC_EQ_INVALID
+ */
+static size_t ERZC_Eq_Cell(ERZC_Label label) {
+    if (label == ERZC_Label_END) return __ERZC_EQ_END;
+    if (ERZC_Label_IsQuasi(label) || ERZC_Label_GetX(label) >= ERZC_WIDTH ||
+        ERZC_Label_GetY(label) >= ERZC_HEIGHT)
+        return __ERZC_EQ_INVALID;
+
+    return (size_t)ERZC_Label_GetY(label) * ERZC_WIDTH + ERZC_Label_GetX(label);
+}
+
+/**
+ * \brief Checks that the label of the pin is either \ref ERZC_Label_END "Label_END" or the
+ * neighbour of the cell in the direction of the pin.
+ *
+ * \return `label` if it is, \ref ERZC_Label_UNDEFINED "Label_UNDEFINED" otherwise
+ */
+static ERZC_Label ERZC_Eq_Pin(size_t cell, uint32_t direction, ERZC_Label label) {
+    ERZC_Label self = (ERZC_Label)((cell % ERZC_WIDTH) | ((cell / ERZC_WIDTH) << 16));
+
+    if (label == ERZC_Label_END || label == ERZC_Program_GetNeighbour(self, direction))
+        return label;
+    return ERZC_Label_UNDEFINED;
+}
+
+/**
+ * \brief Returns label of the next cell for \ref ERZC_OP_GO0 "GOn" and \ref ERZC_OP_PCW "PCx".
+ */
+static ERZC_Label ERZC_Eq_ProgramNext(const ERZC_Program *program, size_t cell) {
+    ERZC_OP op = program->data[cell].op;
+
+    if (__ERZC_EQ_IS_GO(op)) return program->labels[ERZC_OP_GetOkLabel(op)];
+    return ERZC_Eq_Pin(cell, ERZC_OP_GetOk(op), program->data[cell].ok);
+}
+
+/**
+ * \brief Follows not real program instructions starting from the label.
+ *
+ * \details Results for all cells on the chain are memoized, so every cell is walked at most once
+ * per check.
+ */
+static size_t ERZC_Eq_ResolveProgram(const ERZC_Program *program, size_t *memo, ERZC_Label label) {
+    size_t result;
+    size_t start;
+    size_t cell;
+    ERZC_OP op;
+
+    start = cell = ERZC_Eq_Cell(label);
+    if (cell == __ERZC_EQ_END || cell == __ERZC_EQ_INVALID) return cell;
+
+    for (;;) {
+        if (memo[cell] != __ERZC_EQ_UNKNOWN) {
+            result = memo[cell] == __ERZC_EQ_PENDING ? __ERZC_EQ_DIVERGE : memo[cell];
+            break;
+        }
+
+        op = program->data[cell].op;
+        if (__ERZC_EQ_IS_REAL(op)) {
+            result = cell;
+            break;
+        }
+        if (op == ERZC_OP_EMPTY) {
+            result = __ERZC_EQ_END;
+            break;
+        }
+        if (!__ERZC_EQ_IS_GO(op) && !__ERZC_EQ_IS_PC(op)) {
+            result = __ERZC_EQ_INVALID;
+            break;
+        }
+
+        memo[cell] = __ERZC_EQ_PENDING;
+
+        cell = ERZC_Eq_Cell(ERZC_Eq_ProgramNext(program, cell));
+        if (cell == __ERZC_EQ_END || cell == __ERZC_EQ_INVALID) {
+            result = cell;
+            break;
+        }
+    }
+
+    for (cell = start; cell < ERZC_SIZE && memo[cell] == __ERZC_EQ_PENDING;) {
+        memo[cell] = result;
+        cell = ERZC_Eq_Cell(ERZC_Eq_ProgramNext(program, cell));
+    }
+
+    return result;
+}
+
+/**
+ * \brief Inserts the pair into the visited set.
+ *
+ * \return `1` if inserted, `0` if already visited, `-1` if the set is full
+ */
+static int
+ERZC_Eq_Visit(ERZC_EquivalenceScratch *scratch, size_t *visited, size_t in, size_t cell) {
+    size_t mask = scratch->pairs_cap - 1u;
+    size_t i = ((in * 2654435761u) ^ (cell * 40503u)) & mask;
+    ERZC_EquivalencePair *pair;
+
+    for (;; i = (i + 1u) & mask) {
+        pair = &scratch->pairs[i];
+
+        if (pair->in == ERZC_Label_END) break;
+        if ((size_t)pair->in == in && (size_t)pair->cell == cell) return 0;
+    }
+
+    /* NOTE: at least one entry is kept unused, so probing always terminates */
+    if (*visited + 1u >= scratch->pairs_cap) return -1;
+
+    pair->in = (ERZC_Label)in;
+    pair->cell = (ERZC_Label)cell;
+    ++*visited;
+
+    return 1;
+}
+
+ERZC_Equivalence ERZC_CheckEquivalent(
+    const ERZC_InInstructions *in, const ERZC_Program *program, ERZC_EquivalenceScratch *scratch
+) {
+    size_t resolved_in[2];
+    size_t resolved_program[2];
+    size_t pairs;
+    size_t visited = 0;
+    size_t stack_len = 0;
+    size_t i;
+    ERZC_EquivalencePair pair;
+    const ERZC_Instruction *instruction;
+    ERZC_Equivalence result = ERZC_Equivalence_EQUIVALENT;
+
+    ERZC_ASSERT_MSG(in != NULL, "param `in' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(program != NULL, "param `program' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(scratch != NULL, "param `scratch' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(in->data != NULL || in->len == 0, "`in->data' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(
+        scratch->pairs_cap != 0 && (scratch->pairs_cap & (scratch->pairs_cap - 1u)) == 0,
+        "`scratch->pairs_cap' MUST be a power of two"
+    );
+
+    for (i = 0; i < in->len; ++i) scratch->in[i] = __ERZC_EQ_UNKNOWN;
+    for (i = 0; i < ERZC_SIZE; ++i) scratch->program[i] = __ERZC_EQ_UNKNOWN;
+    for (i = 0; i < scratch->pairs_cap; ++i) scratch->pairs[i].in = ERZC_Label_END;
+
+    resolved_in[0] =
+        ERZC_Eq_ResolveIn(in, scratch->in, in->len != 0 ? (ERZC_Label)0 : ERZC_Label_END);
+    resolved_program[0] = ERZC_Eq_ResolveProgram(program, scratch->program, (ERZC_Label)0);
+    pairs = 1;
+
+    for (;;) {
+        for (i = 0; i < pairs; ++i) {
+            if (resolved_in[i] == __ERZC_EQ_UNDEFINED) continue;
+            if (resolved_in[i] == __ERZC_EQ_INVALID) return ERZC_Equivalence_INVALID_INPUT;
+            if (resolved_program[i] == __ERZC_EQ_INVALID) return ERZC_Equivalence_DIFFERENT;
+
+            if (resolved_in[i] == __ERZC_EQ_END || resolved_in[i] == __ERZC_EQ_DIVERGE) {
+                if (resolved_in[i] != resolved_program[i]) return ERZC_Equivalence_DIFFERENT;
+                continue;
+            }
+
+            if (resolved_program[i] == __ERZC_EQ_END || resolved_program[i] == __ERZC_EQ_DIVERGE ||
+                in->data[resolved_in[i]].op != program->data[resolved_program[i]].op)
+                return ERZC_Equivalence_DIFFERENT;
+
+            switch (ERZC_Eq_Visit(scratch, &visited, resolved_in[i], resolved_program[i])) {
+            case 1:
+                pair.in = (ERZC_Label)resolved_in[i];
+                pair.cell = (ERZC_Label)resolved_program[i];
+                scratch->stack[stack_len++] = pair;
+                break;
+            case -1:
+                result = ERZC_Equivalence_UNKNOWN;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (stack_len == 0) break;
+
+        pair = scratch->stack[--stack_len];
+        instruction = &in->data[pair.in];
+
+        resolved_in[0] = ERZC_Eq_ResolveIn(in, scratch->in, instruction->ok);
+        resolved_program[0] = ERZC_Eq_ResolveProgram(
+            program,
+            scratch->program,
+            ERZC_Eq_Pin(pair.cell, ERZC_OP_GetOk(instruction->op), program->data[pair.cell].ok)
+        );
+        pairs = 1;
+
+        if (ERZC_OP_GetErr(instruction->op) != ERZC_PIN_NONE) {
+            resolved_in[1] = ERZC_Eq_ResolveIn(in, scratch->in, instruction->err);
+            resolved_program[1] = ERZC_Eq_ResolveProgram(
+                program,
+                scratch->program,
+                ERZC_Eq_Pin(
+                    pair.cell, ERZC_OP_GetErr(instruction->op), program->data[pair.cell].err
+                )
+            );
+            pairs = 2;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,54 @@
+#include <erzc/core/mnemonic.h>
+
+#include <erzc/common/assert.h>
+
+#include <stddef.h> /* NULL, size_t */
+#include <string.h> /* memcmp */
+
+typedef struct __tagERZC_Mnemonic {
+    const char *str;
+    size_t len;
+    ERZC_OP op;
+} ERZC_Mnemonic;
+
+#define __ERZC_MNEMONIC(name) {#name, sizeof(#name) - 1u, ERZC_OP_##name}
+
+static const ERZC_Mnemonic ERZC_MNEMONICS[] = {
+    __ERZC_MNEMONIC(UNDF),  __ERZC_MNEMONIC(EMPTY), __ERZC_MNEMONIC(PCW),   __ERZC_MNEMONIC(PCA),
+    __ERZC_MNEMONIC(PCS),   __ERZC_MNEMONIC(PCD),   __ERZC_MNEMONIC(GO0),   __ERZC_MNEMONIC(GO1),
+    __ERZC_MNEMONIC(GO2),   __ERZC_MNEMONIC(GO3),   __ERZC_MNEMONIC(GO4),   __ERZC_MNEMONIC(GO5),
+    __ERZC_MNEMONIC(MOVE),  __ERZC_MNEMONIC(DIG),   __ERZC_MNEMONIC(MOVDG), __ERZC_MNEMONIC(RC045),
+    __ERZC_MNEMONIC(RC090), __ERZC_MNEMONIC(RC135), __ERZC_MNEMONIC(RC180), __ERZC_MNEMONIC(CC045),
+    __ERZC_MNEMONIC(CC090), __ERZC_MNEMONIC(CC135), __ERZC_MNEMONIC(SWLK),  __ERZC_MNEMONIC(NWLK),
+    __ERZC_MNEMONIC(SDIG),  __ERZC_MNEMONIC(NDIG),  __ERZC_MNEMONIC(SCRS),  __ERZC_MNEMONIC(NCRS),
+    __ERZC_MNEMONIC(SHND),  __ERZC_MNEMONIC(NHND),
+};
+
+#define ERZC_MNEMONICS_LEN (sizeof(ERZC_MNEMONICS) / sizeof(ERZC_MNEMONICS[0]))
+
+const char *ERZC_OP_GetMnemonic(ERZC_OP op) {
+    size_t i;
+
+    for (i = 0; i < ERZC_MNEMONICS_LEN; ++i) {
+        if (ERZC_MNEMONICS[i].op == op) return ERZC_MNEMONICS[i].str;
+    }
+
+    return NULL;
+}
+
+int ERZC_OP_FromMnemonic(const char *str, size_t len, ERZC_OP *op) {
+    size_t i;
+
+    ERZC_ASSERT_MSG(str != NULL, "param `str' MUST NOT be NULL");
+    ERZC_ASSERT_MSG(op != NULL, "param `op' MUST NOT be NULL");
+
+    for (i = 0; i < ERZC_MNEMONICS_LEN; ++i) {
+        if (ERZC_MNEMONICS[i].len == len && ERZC_MNEMONICS[i].str[0] == str[0] &&
+            memcmp(ERZC_MNEMONICS[i].str, str, len) == 0) {
+            *op = ERZC_MNEMONICS[i].op;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -21,3 +21,36 @@ void ERZC_Program_Init(ERZC_Program *program) {
         *label = ERZC_Label_END;
     }
 }
+
+ERZC_Label ERZC_Program_GetNeighbour(ERZC_Label label, uint32_t direction) {
+    ERZC_Label x = ERZC_Label_GetX(label);
+    ERZC_Label y = ERZC_Label_GetY(label);
+
+    ERZC_ASSERT_MSG(
+        !ERZC_Label_IsQuasi(label) && x < ERZC_WIDTH && y < ERZC_HEIGHT,
+        "param `label' MUST be inside the program"
+    );
+
+    switch (direction) {
+    case ERZC_Direction_UP:
+        if (y == 0) return ERZC_Label_UNDEFINED;
+        --y;
+        break;
+    case ERZC_Direction_LEFT:
+        if (x == 0) return ERZC_Label_UNDEFINED;
+        --x;
+        break;
+    case ERZC_Direction_DOWN:
+        if (y + 1u == ERZC_HEIGHT) return ERZC_Label_UNDEFINED;
+        ++y;
+        break;
+    case ERZC_Direction_RIGHT:
+        if (x + 1u == ERZC_WIDTH) return ERZC_Label_UNDEFINED;
+        ++x;
+        break;
+    default:
+        return ERZC_Label_UNDEFINED;
+    }
+
+    return x | (y << 16);
+}
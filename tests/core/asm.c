@@ -0,0 +1,135 @@
+#include <erzc/core/asm.h>
+
+#include "../test.h"
+
+#include <string.h> /* memset, strlen */
+
+#define DATA_CAP 16u
+#define SYMBOLS_CAP 16u
+
+static ERZC_Instruction data[DATA_CAP];
+static ERZC_AsmSymbol symbols[SYMBOLS_CAP];
+static ERZC_Assembler assembler;
+static ERZC_InInstructions out;
+
+static void Reset(size_t cap, size_t symbols_cap) {
+    memset(&assembler, 0, sizeof(assembler));
+    memset(symbols, 0, sizeof(symbols));
+    assembler.data = data;
+    assembler.cap = cap;
+    assembler.symbols = symbols;
+    assembler.symbols_cap = symbols_cap;
+}
+
+static ERZC_AsmStatus Assemble(const char *src) {
+    return ERZC_Assemble(&assembler, src, strlen(src), &out);
+}
+
+static void TestForwardReferences(void) {
+    Reset(DATA_CAP, SYMBOLS_CAP);
+
+    ERZC_TEST_CHECK(
+        Assemble("a: SWLK b c ; comment\nb: MOVE a _\nc: RC090 END\n") == ERZC_AsmStatus_OK
+    );
+    ERZC_TEST_CHECK(out.len == 3);
+    ERZC_TEST_CHECK(out.data[0].op == ERZC_OP_SWLK);
+    ERZC_TEST_CHECK(out.data[0].ok == 1 && out.data[0].err == 2);
+    ERZC_TEST_CHECK(out.data[1].ok == 0 && out.data[1].err == ERZC_Label_UNDEFINED);
+    ERZC_TEST_CHECK(out.data[2].op == ERZC_OP_RC090 && out.data[2].ok == ERZC_Label_END);
+}
+
+static void TestTrailingSymbol(void) {
+    Reset(DATA_CAP, SYMBOLS_CAP);
+
+    ERZC_TEST_CHECK(Assemble("MOVE done\nEMPTY\ndone:\n") == ERZC_AsmStatus_OK);
+    ERZC_TEST_CHECK(out.len == 2);
+    ERZC_TEST_CHECK(out.data[0].ok == ERZC_Label_END);
+    ERZC_TEST_CHECK(out.data[1].op == ERZC_OP_EMPTY && out.data[1].ok == ERZC_Label_END);
+}
+
+static void TestMnemonics(void) {
+    Reset(DATA_CAP, SYMBOLS_CAP);
+
+    ERZC_TEST_CHECK(Assemble("SHND END END\nNHND\nSWLK\n") == ERZC_AsmStatus_OK);
+    ERZC_TEST_CHECK(out.data[0].op == ERZC_OP_SHND);
+    ERZC_TEST_CHECK(out.data[1].op == ERZC_OP_NHND);
+    ERZC_TEST_CHECK(out.data[2].op == ERZC_OP_SWLK);
+    ERZC_TEST_CHECK(ERZC_OP_SHND != ERZC_OP_SWLK && ERZC_OP_NHND != ERZC_OP_NWLK);
+}
+
+static void TestSplitting(void) {
+    const char *src = "a: MOVE a END\n--- ; next\nb: DIG b\n  ---\nRC090\n";
+    size_t len = strlen(src);
+
+    Reset(DATA_CAP, SYMBOLS_CAP);
+
+    ERZC_TEST_CHECK(ERZC_Assemble(&assembler, src, len, &out) == ERZC_AsmStatus_OK);
+    ERZC_TEST_CHECK(out.len == 1 && out.data[0].op == ERZC_OP_MOVE && out.data[0].ok == 0);
+    ERZC_TEST_CHECK(assembler.consumed == strlen("a: MOVE a END\n--- ; next\n"));
+    ERZC_TEST_CHECK(assembler.lines == 2);
+    src += assembler.consumed;
+    len -= assembler.consumed;
+
+    /* NOTE: `a' is not visible in the next program */
+    ERZC_TEST_CHECK(ERZC_Assemble(&assembler, src, len, &out) == ERZC_AsmStatus_OK);
+    ERZC_TEST_CHECK(out.len == 1 && out.data[0].op == ERZC_OP_DIG && out.data[0].ok == 0);
+    ERZC_TEST_CHECK(assembler.lines == 2);
+    src += assembler.consumed;
+    len -= assembler.consumed;
+
+    ERZC_TEST_CHECK(ERZC_Assemble(&assembler, src, len, &out) == ERZC_AsmStatus_OK);
+    ERZC_TEST_CHECK(out.len == 1 && out.data[0].op == ERZC_OP_RC090);
+    ERZC_TEST_CHECK(assembler.consumed == len);
+}
+
+static void TestError(
+    const char *src, size_t cap, size_t symbols_cap, ERZC_AsmStatus status, size_t line
+) {
+    Reset(cap, symbols_cap);
+
+    ERZC_TEST_CHECK(Assemble(src) == status);
+    ERZC_TEST_CHECK(assembler.line == line);
+}
+
+static void TestErrors(void) {
+    TestError("MOVE ,\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_SYNTAX, 1);
+    TestError("\nEND: MOVE\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_SYNTAX, 2);
+    TestError("a: ---\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_SYNTAX, 1);
+    TestError("FOO\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_MNEMONIC, 1);
+    TestError("GO0\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_MNEMONIC, 1);
+    TestError("UNDF\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_MNEMONIC, 1);
+    TestError("RC090 END END\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_PINS, 1);
+    TestError("EMPTY END\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_PINS, 1);
+    TestError("a: MOVE\na: DIG\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_DUPLICATE_SYMBOL, 2);
+    TestError("MOVE\nDIG x\n", DATA_CAP, SYMBOLS_CAP, ERZC_AsmStatus_UNDEFINED_SYMBOL, 2);
+    TestError("MOVE\nDIG\n", 1, SYMBOLS_CAP, ERZC_AsmStatus_NO_DATA_SPACE, 2);
+    TestError("MOVE a b\n", DATA_CAP, 1, ERZC_AsmStatus_NO_SYMBOL_SPACE, 1);
+}
+
+static void TestErrorRecovery(void) {
+    const char *src = "MOVE\nFOO\nDIG\n---\nRC090\n";
+    size_t len = strlen(src);
+
+    Reset(DATA_CAP, SYMBOLS_CAP);
+
+    ERZC_TEST_CHECK(ERZC_Assemble(&assembler, src, len, &out) == ERZC_AsmStatus_MNEMONIC);
+    ERZC_TEST_CHECK(assembler.line == 2);
+    ERZC_TEST_CHECK(assembler.consumed == strlen("MOVE\nFOO\nDIG\n---\n"));
+    ERZC_TEST_CHECK(assembler.lines == 4);
+    src += assembler.consumed;
+    len -= assembler.consumed;
+
+    ERZC_TEST_CHECK(ERZC_Assemble(&assembler, src, len, &out) == ERZC_AsmStatus_OK);
+    ERZC_TEST_CHECK(out.len == 1 && out.data[0].op == ERZC_OP_RC090);
+}
+
+int main(void) {
+    TestForwardReferences();
+    TestTrailingSymbol();
+    TestMnemonics();
+    TestSplitting();
+    TestErrors();
+    TestErrorRecovery();
+
+    return ERZC_TEST_RESULT();
+}
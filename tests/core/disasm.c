@@ -0,0 +1,67 @@
+#include <erzc/core/disasm.h>
+#include <erzc/core/program.h>
+
+#include "../test.h"
+
+#include <string.h> /* memcmp, strlen, strstr */
+
+#define LABEL(x, y) ((ERZC_Label)((x) | ((y) << 16)))
+
+static ERZC_Program program;
+static char full[ERZC_SIZE * 8u];
+static char part[16];
+
+static void Set(unsigned x, unsigned y, ERZC_OP op, ERZC_Label ok, ERZC_Label err) {
+    ERZC_Instruction *instruction = &program.data[y * ERZC_WIDTH + x];
+
+    instruction->op = op;
+    instruction->ok = ok;
+    instruction->err = err;
+}
+
+static void TestListing(void) {
+    size_t len;
+
+    ERZC_Program_Init(&program);
+    program.labels[2] = LABEL(0, 0);
+    Set(0, 0, ERZC_OP_MOVE, LABEL(1, 0), ERZC_Label_END);
+    Set(1, 0, ERZC_OP_SHND, LABEL(2, 0), LABEL(1, 1));
+    Set(2, 0, ERZC_OP_GO2, LABEL(5, 5), ERZC_Label_END); /* NOTE: ok of GOn has no effect */
+    Set(3, 0, ERZC_OP_EMPTY, LABEL(5, 5), ERZC_Label_END);
+
+    len = ERZC_Disassemble(&program, full, sizeof(full));
+
+    ERZC_TEST_CHECK(len == strlen(full));
+    ERZC_TEST_CHECK(memcmp(full, "GO2: 0 0\nMOVE  SHND  GO2   EMPTY .", 34) == 0);
+    ERZC_TEST_CHECK(strstr(full, "\n0 0: err=END\n") != NULL);
+    ERZC_TEST_CHECK(strstr(full, "\n1 0:") == NULL);
+    ERZC_TEST_CHECK(strstr(full, "\n2 0:") == NULL);
+    ERZC_TEST_CHECK(strstr(full, "\n3 0:") == NULL);
+}
+
+static void TestTruncation(void) {
+    size_t len;
+
+    ERZC_Program_Init(&program);
+    Set(0, 0, ERZC_OP_RC090, ERZC_Label_END, ERZC_Label_END);
+
+    len = ERZC_Disassemble(&program, full, sizeof(full));
+    ERZC_TEST_CHECK(len == strlen(full));
+
+    ERZC_TEST_CHECK(ERZC_Disassemble(&program, NULL, 0) == len);
+
+    memset(part, '#', sizeof(part));
+    ERZC_TEST_CHECK(ERZC_Disassemble(&program, part, 1) == len);
+    ERZC_TEST_CHECK(part[0] == '\0' && part[1] == '#');
+
+    memset(part, '#', sizeof(part));
+    ERZC_TEST_CHECK(ERZC_Disassemble(&program, part, 8) == len);
+    ERZC_TEST_CHECK(memcmp(part, full, 7) == 0 && part[7] == '\0' && part[8] == '#');
+}
+
+int main(void) {
+    TestListing();
+    TestTruncation();
+
+    return ERZC_TEST_RESULT();
+}
@@ -0,0 +1,129 @@
+#include <erzc/core/equivalence.h>
+#include <erzc/core/program.h>
+
+#include "../test.h"
+
+#define LABEL(x, y) ((ERZC_Label)((x) | ((y) << 16)))
+
+#define IN_CAP 8u
+#define PAIRS_CAP 64u
+
+static ERZC_Program program;
+static ERZC_Instruction data[IN_CAP];
+static ERZC_InInstructions in = {0, data};
+
+static size_t scratch_in[IN_CAP];
+static size_t scratch_program[ERZC_SIZE];
+static ERZC_EquivalencePair pairs[PAIRS_CAP];
+static ERZC_EquivalencePair stack[PAIRS_CAP];
+static ERZC_EquivalenceScratch scratch = {
+    scratch_in, scratch_program, pairs, stack, PAIRS_CAP
+};
+
+static void SetIn(size_t i, ERZC_OP op, ERZC_Label ok, ERZC_Label err) {
+    data[i].op = op;
+    data[i].ok = ok;
+    data[i].err = err;
+    if (in.len <= i) in.len = i + 1u;
+}
+
+static void Set(unsigned x, unsigned y, ERZC_OP op, ERZC_Label ok, ERZC_Label err) {
+    ERZC_Instruction *instruction = &program.data[y * ERZC_WIDTH + x];
+
+    instruction->op = op;
+    instruction->ok = ok;
+    instruction->err = err;
+}
+
+static ERZC_Equivalence Check(void) {
+    return ERZC_CheckEquivalent(&in, &program, &scratch);
+}
+
+/**
+ * \brief `0: SWLK 1 2; 1: MOVE _; 2: MOVE END END` and program with `1` and `2` merged into
+ * `(0, 1)`.
+ */
+static void Setup(void) {
+    in.len = 0;
+    SetIn(0, ERZC_OP_SWLK, 1, 2);
+    SetIn(1, ERZC_OP_MOVE, ERZC_Label_UNDEFINED, ERZC_Label_UNDEFINED);
+    SetIn(2, ERZC_OP_MOVE, ERZC_Label_END, ERZC_Label_END);
+
+    ERZC_Program_Init(&program);
+    Set(0, 0, ERZC_OP_SWLK, LABEL(1, 0), LABEL(0, 1));
+    Set(1, 0, ERZC_OP_PCS, LABEL(1, 1), ERZC_Label_END);
+    Set(1, 1, ERZC_OP_PCA, LABEL(0, 1), ERZC_Label_END);
+    Set(0, 1, ERZC_OP_MOVE, ERZC_Label_END, ERZC_Label_END);
+}
+
+static void TestEquivalent(void) {
+    Setup();
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_EQUIVALENT);
+
+    /* NOTE: named labels and don't care */
+    Setup();
+    program.labels[0] = LABEL(0, 1);
+    Set(1, 0, ERZC_OP_GO0, ERZC_Label_END, ERZC_Label_END);
+    Set(0, 1, ERZC_OP_MOVE, ERZC_Label_END, LABEL(0, 2));
+    Set(0, 2, ERZC_OP_EMPTY, ERZC_Label_END, ERZC_Label_END);
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_EQUIVALENT);
+
+    /* NOTE: both loop forever without real instructions */
+    in.len = 0;
+    SetIn(0, ERZC_OP_PCW, 1, ERZC_Label_UNDEFINED);
+    SetIn(1, ERZC_OP_PCW, 0, ERZC_Label_UNDEFINED);
+    ERZC_Program_Init(&program);
+    Set(0, 0, ERZC_OP_PCD, LABEL(1, 0), ERZC_Label_END);
+    Set(1, 0, ERZC_OP_PCA, LABEL(0, 0), ERZC_Label_END);
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_EQUIVALENT);
+}
+
+static void TestDifferent(void) {
+    /* NOTE: op mismatch */
+    Setup();
+    Set(0, 1, ERZC_OP_DIG, ERZC_Label_END, ERZC_Label_END);
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_DIFFERENT);
+
+    /* NOTE: ok label disagrees with the direction of the pin */
+    Setup();
+    Set(0, 0, ERZC_OP_SWLK, LABEL(0, 1), LABEL(0, 1));
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_DIFFERENT);
+
+    /* NOTE: END vs divergence */
+    Setup();
+    Set(0, 1, ERZC_OP_MOVE, LABEL(1, 1), ERZC_Label_END);
+    Set(1, 1, ERZC_OP_PCW, LABEL(1, 0), ERZC_Label_END);
+    Set(1, 0, ERZC_OP_PCS, LABEL(1, 1), ERZC_Label_END);
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_DIFFERENT);
+
+    /* NOTE: UNDF reached */
+    Setup();
+    Set(0, 1, ERZC_OP_UNDF, ERZC_Label_END, ERZC_Label_END);
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_DIFFERENT);
+}
+
+static void TestUnknown(void) {
+    Setup();
+    scratch.pairs_cap = 2;
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_UNKNOWN);
+    scratch.pairs_cap = PAIRS_CAP;
+}
+
+static void TestInvalidInput(void) {
+    Setup();
+    SetIn(2, ERZC_OP_MOVE, 7, ERZC_Label_END);
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_INVALID_INPUT);
+
+    Setup();
+    SetIn(2, ERZC_OP_GO0, ERZC_Label_END, ERZC_Label_END);
+    ERZC_TEST_CHECK(Check() == ERZC_Equivalence_INVALID_INPUT);
+}
+
+int main(void) {
+    TestEquivalent();
+    TestDifferent();
+    TestUnknown();
+    TestInvalidInput();
+
+    return ERZC_TEST_RESULT();
+}
@@ -0,0 +1,35 @@
+#ifndef _ERZC_TESTS_TEST_H
+#define _ERZC_TESTS_TEST_H
+
+/**
+ * \file
+ *
+ * \brief Minimal test helpers.
+ *
+ * \details Each test is a standalone program linked with the library sources. It prints failed
+ * checks and returns non-zero exit code if any of them failed.
+ */
+
+#include <stdio.h> /* fprintf */
+
+static int erzc_test_failed = 0;
+
+/**
+ * \brief Checks the expression, reports it and marks the test as failed if it's false.
+ *
+ * \param expr expression
+ */
+#define ERZC_TEST_CHECK(expr)                                                                      \
+    do {                                                                                           \
+        if (!(expr)) {                                                                             \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #expr);               \
+            erzc_test_failed = 1;                                                                  \
+        }                                                                                          \
+    } while (0)
+
+/**
+ * \brief Exit code of the test.
+ */
+#define ERZC_TEST_RESULT() (erzc_test_failed ? 1 : 0)
+
+#endif /* _ERZC_TESTS_TEST_H */